@@ -0,0 +1,65 @@
+#pragma once
+
+#include "IDecomposer.h"
+#include "IMultiplier.h"
+#include <span>
+
+/**
+ * Liczba double-double: wartość hi + lo, gdzie |lo| <= pół ULP(hi).
+ */
+struct DoubleDouble {
+    double hi; // Część główna (zaokrąglona wartość)
+    double lo; // Część korygująca (błąd zaokrąglenia hi)
+};
+
+/**
+ * Mnożenie w arytmetyce double-double zbudowane na TwoProduct symulatora.
+ * Błąd iloczynu hi * hi jest odczytywany z dokładnego iloczynu mantys, bez FMA ani podziału Dekkera.
+ */
+class DoubleDoubleMultiplier {
+public:
+    DoubleDoubleMultiplier(const IDecomposer &decomposer, const IMultiplier &multiplier);
+
+    /**
+     * Bezbłędne mnożenie dwóch liczb double.
+     * @return Para (hi, lo), gdzie hi = fl(a * b), a lo = a * b - hi.
+     */
+    [[nodiscard]] DoubleDouble twoProduct(double a, double b) const;
+
+    /**
+     * Mnoży dwie liczby double-double.
+     */
+    [[nodiscard]] DoubleDouble multiply(const DoubleDouble &x, const DoubleDouble &y) const;
+
+    /**
+     * Mnoży liczbę double-double przez liczbę double.
+     */
+    [[nodiscard]] DoubleDouble multiply(const DoubleDouble &x, double y) const;
+
+    /**
+     * Wsadowe TwoProduct: out[i] = twoProduct(a[i], b[i]).
+     * @throws std::invalid_argument gdy długości zakresów się różnią.
+     */
+    void twoProduct(std::span<const double> a, std::span<const double> b, std::span<DoubleDouble> out) const;
+
+    /**
+     * Wsadowe mnożenie double-double: out[i] = x[i] * y[i].
+     * @throws std::invalid_argument gdy długości zakresów się różnią.
+     */
+    void multiply(std::span<const DoubleDouble> x, std::span<const DoubleDouble> y,
+                  std::span<DoubleDouble> out) const;
+
+    /**
+     * Wsadowe mnożenie double-double przez double: out[i] = x[i] * y[i].
+     * @throws std::invalid_argument gdy długości zakresów się różnią.
+     */
+    void multiply(std::span<const DoubleDouble> x, std::span<const double> y, std::span<DoubleDouble> out) const;
+
+private:
+    const IDecomposer &decomposer;
+    const IMultiplier &multiplier;
+
+    [[nodiscard]] double product(double a, double b) const;
+
+    [[nodiscard]] static DoubleDouble quickTwoSum(double a, double b);
+};
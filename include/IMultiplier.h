@@ -2,6 +2,16 @@
 
 #include "FloatData.h"
 
+/**
+ * Wynik bezbłędnego mnożenia (TwoProduct): iloczyn zaokrąglony oraz błąd zaokrąglenia.
+ * Równość a * b = product + error jest dokładna, o ile sam błąd nie wpada w niedomiar
+ * (z grubsza e_a + e_b >= -1022 + 52); normalny iloczyn tego nie gwarantuje.
+ */
+struct TwoProductData {
+    FloatData product; // Iloczyn zaokrąglony (round to nearest, ties to even)
+    FloatData error; // Reszta (a * b) - product, dokładna poza niedomiarem błędu
+};
+
 /**
  * Interfejs definiujący kontrakt na operację mnożenia dwóch struktur FloatData.
  */
@@ -16,4 +26,16 @@ public:
      * @return Wynik mnożenia (znormalizowany i zaokrąglony).
      */
     [[nodiscard]] virtual FloatData multiply(const FloatData &a, const FloatData &b) const = 0;
+
+    /**
+     * Mnoży dwie liczby, zwracając iloczyn zaokrąglony oraz błąd zaokrąglenia jako drugą liczbę binary64.
+     * Równość a * b = product + error jest dokładna, o ile sam błąd nie wpada w niedomiar
+     * (z grubsza e_a + e_b >= -1022 + 52); normalny iloczyn tego nie gwarantuje.
+     * W przeciwnym razie błąd jest jedynie zaokrągleniem dokładnej reszty.
+     * Jeśli iloczyn jest Inf lub NaN, błąd jest NaN.
+     * @param a Pierwszy czynnik.
+     * @param b Drugi czynnik.
+     * @return Para (iloczyn, błąd).
+     */
+    [[nodiscard]] virtual TwoProductData twoProduct(const FloatData &a, const FloatData &b) const = 0;
 };
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Histogram opóźnień w stylu HDR: kubełki logarytmiczno-liniowe
+ * (128 podkubełków na każdą potęgę dwójki, błąd względny < 1%).
+ */
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    void record(uint64_t valueNs);
+
+    /**
+     * Zwraca wartość, poniżej (lub równo) której leży zadany procent próbek.
+     * @param percentile Percentyl z zakresu [0, 100], np. 99.9; wartości spoza zakresu są przycinane,
+     *                   a sam percentyl kwantyzowany do 10^-4 %.
+     * @return Górna granica kubełka zawierającego percentyl (0 dla pustego histogramu).
+     * @throws std::invalid_argument gdy percentyl jest NaN.
+     */
+    [[nodiscard]] uint64_t valueAtPercentile(double percentile) const;
+
+    [[nodiscard]] uint64_t count() const;
+
+    [[nodiscard]] uint64_t min() const;
+
+    [[nodiscard]] uint64_t max() const;
+
+    [[nodiscard]] double mean() const;
+
+    /**
+     * Indeks kubełka dla wartości: dokładny poniżej 128, dalej 128 podkubełków na potęgę dwójki.
+     */
+    [[nodiscard]] static std::size_t bucketIndex(uint64_t value);
+
+    /**
+     * Największa wartość należąca do kubełka o danym indeksie.
+     */
+    [[nodiscard]] static uint64_t bucketUpperBound(std::size_t index);
+
+private:
+    std::vector<uint64_t> buckets;
+    uint64_t total;
+    uint64_t minValue;
+    uint64_t maxValue;
+    long double sum;
+};
@@ -8,4 +8,23 @@
 class Multiplier final : public IMultiplier {
 public:
     [[nodiscard]] FloatData multiply(const FloatData &a, const FloatData &b) const override;
+
+    [[nodiscard]] TwoProductData twoProduct(const FloatData &a, const FloatData &b) const override;
+
+private:
+    /**
+     * Obsługuje przypadki specjalne (NaN, Inf, Zero).
+     * @return true, jeśli wynik został ustalony bez mnożenia mantys.
+     */
+    static bool multiplySpecial(const FloatData &a, const FloatData &b, FloatData &result);
+
+    /**
+     * Wylicza dokładny iloczyn znaczących: a * b = prod * 2^lsbExp.
+     */
+    static void exactProduct(const FloatData &a, const FloatData &b, __uint128_t &prod, int &lsbExp);
+
+    /**
+     * Zaokrągla wartość sig * 2^lsbExp do binary64 (round to nearest, ties to even) i pakuje wynik.
+     */
+    [[nodiscard]] static FloatData roundAndPack(bool sign, __uint128_t sig, int lsbExp);
 };
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "IMultiplier.h"
+#include "WorkloadLog.h"
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+/**
+ * Dekorator IMultiplier nagrywający każdą parę argumentów do dziennika obciążenia,
+ * a następnie przekazujący wywołanie do właściwej implementacji.
+ */
+class RecordingMultiplier final : public IMultiplier {
+public:
+    /**
+     * @param inner Właściwa implementacja mnożenia.
+     * @param logPath Ścieżka pliku dziennika.
+     * @param policy Domyślnie każdy rekord trafia od razu do pliku, bo sesję interaktywną
+     *               zwykle kończy się Ctrl+C, bez wywołania destruktora.
+     */
+    RecordingMultiplier(std::unique_ptr<IMultiplier> inner, const std::string &logPath,
+                        WorkloadLogWriter::FlushPolicy policy = WorkloadLogWriter::FlushPolicy::EveryRecord);
+
+    ~RecordingMultiplier() override;
+
+    [[nodiscard]] FloatData multiply(const FloatData &a, const FloatData &b) const override;
+
+    [[nodiscard]] TwoProductData twoProduct(const FloatData &a, const FloatData &b) const override;
+
+private:
+    std::unique_ptr<IMultiplier> inner;
+    std::chrono::steady_clock::time_point start;
+
+    // Nagrywanie nie zmienia obserwowalnego stanu mnożenia, stąd mutable w metodach const
+    mutable WorkloadLogWriter writer;
+    mutable std::mutex writerMutex;
+
+    void record(const FloatData &a, const FloatData &b, WorkloadRecord::Operation operation) const;
+};
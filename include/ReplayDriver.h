@@ -0,0 +1,62 @@
+#pragma once
+
+#include "IDecomposer.h"
+#include "IMultiplier.h"
+#include "LatencyHistogram.h"
+#include "WorkloadLog.h"
+#include <array>
+#include <ostream>
+#include <vector>
+
+/**
+ * Klasa pary argumentów, według której dzielone są statystyki opóźnień.
+ */
+enum class OperandClass {
+    Normal, // Oba czynniki normalne
+    Subnormal, // Co najmniej jeden czynnik subnormalny
+    Special, // Co najmniej jeden czynnik Zero, Inf lub NaN
+    Count
+};
+
+/**
+ * Klasyfikuje parę argumentów (przypadki specjalne mają pierwszeństwo przed subnormalnymi).
+ */
+[[nodiscard]] OperandClass classifyOperands(const FloatData &a, const FloatData &b);
+
+/**
+ * Wynik odtworzenia dziennika: histogramy opóźnień pojedynczych operacji.
+ */
+struct ReplayReport {
+    LatencyHistogram overall;
+    std::array<LatencyHistogram, static_cast<std::size_t>(OperandClass::Count)> byClass;
+    uint64_t wallTimeNs = 0; // Całkowity czas odtwarzania
+    uint64_t checksum = 0; // Suma kontrolna wyników (do porównywania implementacji)
+
+    void print(std::ostream &os) const;
+};
+
+/**
+ * Odtwarza nagrany dziennik obciążenia na dowolnej implementacji IMultiplier.
+ */
+class ReplayDriver {
+public:
+    // Tempo odtwarzania
+    enum class Pace {
+        FullSpeed, // Operacje jedna po drugiej, bez przerw
+        OriginalRate // Zachowanie odstępów czasowych z nagrania
+    };
+
+    ReplayDriver(const IDecomposer &decomposer, const IMultiplier &multiplier);
+
+    /**
+     * Wykonuje ponownie wszystkie operacje z dziennika, mierząc czas każdego wywołania mnożenia.
+     * @param records Wpisy wczytane przez readWorkloadLog.
+     * @param pace Tempo odtwarzania.
+     * @return Raport z histogramami opóźnień.
+     */
+    [[nodiscard]] ReplayReport replay(const std::vector<WorkloadRecord> &records, Pace pace) const;
+
+private:
+    const IDecomposer &decomposer;
+    const IMultiplier &multiplier;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * Pojedynczy wpis dziennika obciążenia: para argumentów przekazana do IMultiplier.
+ */
+struct WorkloadRecord {
+    // Rodzaj wywołanej operacji
+    enum class Operation : uint8_t {
+        Multiply,
+        TwoProduct
+    };
+
+    uint64_t timestampNs; // Czas od rozpoczęcia nagrywania (ns)
+    uint64_t aBits; // Surowe bity pierwszego czynnika
+    uint64_t bBits; // Surowe bity drugiego czynnika
+    Operation operation;
+};
+
+/**
+ * Zapisuje wpisy WorkloadRecord do zwartego pliku binarnego.
+ * Format: nagłówek "B64W" + wersja (uint32), potem rekordy po 25 bajtów (little-endian).
+ */
+class WorkloadLogWriter {
+public:
+    // Kiedy rekordy trafiają z bufora do pliku
+    enum class FlushPolicy {
+        Buffered, // Tylko przy flush() i zamknięciu pliku (najszybciej)
+        EveryRecord // Po każdym rekordzie, aby przerwana sesja (np. Ctrl+C) nie traciła nagrania
+    };
+
+    /**
+     * Otwiera plik do zapisu i zapisuje nagłówek (od razu przenoszony do pliku).
+     * @param path Ścieżka pliku dziennika.
+     * @param policy Polityka opróżniania bufora po każdym append().
+     * @throws std::runtime_error gdy pliku nie da się otworzyć lub zapisać nagłówka.
+     */
+    explicit WorkloadLogWriter(const std::string &path, FlushPolicy policy = FlushPolicy::Buffered);
+
+    /**
+     * Dopisuje rekord na koniec dziennika.
+     * @throws std::runtime_error gdy zapis się nie powiedzie (np. brak miejsca na dysku).
+     */
+    void append(const WorkloadRecord &record);
+
+    /**
+     * Wymusza zapis buforowanych rekordów do pliku.
+     * @throws std::runtime_error gdy zapis się nie powiedzie.
+     */
+    void flush();
+
+private:
+    std::ofstream out;
+    FlushPolicy policy;
+};
+
+/**
+ * Wczytuje cały dziennik obciążenia zapisany przez WorkloadLogWriter.
+ * @throws std::runtime_error gdy plik nie istnieje, ma zły nagłówek lub jest ucięty.
+ */
+[[nodiscard]] std::vector<WorkloadRecord> readWorkloadLog(const std::string &path);
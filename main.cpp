@@ -1,16 +1,63 @@
 #include "Menu.h"
 #include "Decomposer.h"
 #include "Multiplier.h"
+#include "RecordingMultiplier.h"
+#include "ReplayDriver.h"
+#include <iostream>
 #include <memory>
+#include <stdexcept>
+#include <string>
 
-int main() {
-    auto decomposer = std::make_unique<Decomposer>();
-    auto multiplier = std::make_unique<Multiplier>();
+namespace {
+    void printUsage(const char *program) {
+        std::cout << "Uzycie:\n"
+                << "  " << program << "                            tryb interaktywny\n"
+                << "  " << program << " --record <plik>            tryb interaktywny z nagrywaniem argumentow\n"
+                << "  " << program << " --replay <plik> [--original-rate]  odtworzenie nagrania\n";
+    }
 
-    Simulator simulator(std::move(decomposer), std::move(multiplier));
+    int runReplay(const std::string &path, const ReplayDriver::Pace pace) {
+        const std::vector<WorkloadRecord> records = readWorkloadLog(path);
 
-    Menu menu(simulator);
-    menu.display();
+        const Decomposer decomposer;
+        const Multiplier multiplier;
+        const ReplayDriver driver(decomposer, multiplier);
+
+        std::cout << "Odtwarzanie " << records.size() << " operacji z pliku " << path << "...\n";
+        driver.replay(records, pace).print(std::cout);
+        return 0;
+    }
+}
+
+int main(const int argc, char *argv[]) {
+    try {
+        auto decomposer = std::make_unique<Decomposer>();
+        std::unique_ptr<IMultiplier> multiplier = std::make_unique<Multiplier>();
+
+        if (argc >= 3 && std::string(argv[1]) == "--replay") {
+            const bool originalRate = argc == 4 && std::string(argv[3]) == "--original-rate";
+            if (argc > 4 || (argc == 4 && !originalRate)) {
+                printUsage(argv[0]);
+                return 1;
+            }
+            return runReplay(argv[2], originalRate ? ReplayDriver::Pace::OriginalRate : ReplayDriver::Pace::FullSpeed);
+        }
+
+        if (argc == 3 && std::string(argv[1]) == "--record") {
+            multiplier = std::make_unique<RecordingMultiplier>(std::move(multiplier), argv[2]);
+        } else if (argc != 1) {
+            printUsage(argv[0]);
+            return 1;
+        }
+
+        Simulator simulator(std::move(decomposer), std::move(multiplier));
+
+        Menu menu(simulator);
+        menu.display();
+    } catch (const std::runtime_error &e) {
+        std::cout << "Blad: " << e.what() << "\n";
+        return 1;
+    }
 
     return 0;
 }
@@ -0,0 +1,72 @@
+#include "DoubleDouble.h"
+#include <cmath>
+#include <stdexcept>
+
+DoubleDoubleMultiplier::DoubleDoubleMultiplier(const IDecomposer &decomposer, const IMultiplier &multiplier)
+    : decomposer(decomposer), multiplier(multiplier) {
+}
+
+DoubleDouble DoubleDoubleMultiplier::twoProduct(const double a, const double b) const {
+    const TwoProductData data = multiplier.twoProduct(decomposer.decompose(a), decomposer.decompose(b));
+    return {decomposer.compose(data.product), decomposer.compose(data.error)};
+}
+
+DoubleDouble DoubleDoubleMultiplier::multiply(const DoubleDouble &x, const DoubleDouble &y) const {
+    // Iloczyn części głównych liczymy bezbłędnie, składniki mieszane wystarczy zaokrąglić,
+    // bo są o ~53 bity mniejsze od hi (iloczyn lo * lo pomijamy).
+    const DoubleDouble p = twoProduct(x.hi, y.hi);
+    // Dla Inf/NaN błąd z TwoProduct jest NaN, więc wynik zwracamy bez korekty
+    if (!std::isfinite(p.hi))
+        return {p.hi, 0.0};
+
+    const double cross = p.lo + (product(x.hi, y.lo) + product(x.lo, y.hi));
+    return quickTwoSum(p.hi, cross);
+}
+
+DoubleDouble DoubleDoubleMultiplier::multiply(const DoubleDouble &x, const double y) const {
+    const DoubleDouble p = twoProduct(x.hi, y);
+    if (!std::isfinite(p.hi))
+        return {p.hi, 0.0};
+
+    return quickTwoSum(p.hi, p.lo + product(x.lo, y));
+}
+
+void DoubleDoubleMultiplier::twoProduct(const std::span<const double> a, const std::span<const double> b,
+                                        const std::span<DoubleDouble> out) const {
+    if (a.size() != b.size() || a.size() != out.size())
+        throw std::invalid_argument("DoubleDoubleMultiplier::twoProduct: rozne dlugosci zakresow");
+
+    for (std::size_t i = 0; i < a.size(); ++i)
+        out[i] = twoProduct(a[i], b[i]);
+}
+
+void DoubleDoubleMultiplier::multiply(const std::span<const DoubleDouble> x, const std::span<const DoubleDouble> y,
+                                      const std::span<DoubleDouble> out) const {
+    if (x.size() != y.size() || x.size() != out.size())
+        throw std::invalid_argument("DoubleDoubleMultiplier::multiply: rozne dlugosci zakresow");
+
+    for (std::size_t i = 0; i < x.size(); ++i)
+        out[i] = multiply(x[i], y[i]);
+}
+
+void DoubleDoubleMultiplier::multiply(const std::span<const DoubleDouble> x, const std::span<const double> y,
+                                      const std::span<DoubleDouble> out) const {
+    if (x.size() != y.size() || x.size() != out.size())
+        throw std::invalid_argument("DoubleDoubleMultiplier::multiply: rozne dlugosci zakresow");
+
+    for (std::size_t i = 0; i < x.size(); ++i)
+        out[i] = multiply(x[i], y[i]);
+}
+
+double DoubleDoubleMultiplier::product(const double a, const double b) const {
+    return decomposer.compose(multiplier.multiply(decomposer.decompose(a), decomposer.decompose(b)));
+}
+
+DoubleDouble DoubleDoubleMultiplier::quickTwoSum(const double a, const double b) {
+    // Fast TwoSum (Dekker), wymaga |a| >= |b|
+    // Przepełnienie może jeszcze wywołać dodanie składników mieszanych (a tuż przy granicy zakresu)
+    const double s = a + b;
+    if (!std::isfinite(s))
+        return {s, 0.0};
+    return {s, b - (s - a)};
+}
@@ -0,0 +1,97 @@
+#include "LatencyHistogram.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    // 2^kSubBits podkubełków na każdą potęgę dwójki
+    constexpr int kSubBits = 7;
+    constexpr uint64_t kSubCount = 1ULL << kSubBits;
+    constexpr std::size_t kBucketCount = (64 - kSubBits + 1) * kSubCount;
+
+    // Dokładność percentyla: 10^4 jednostek na 1 %
+    constexpr int64_t kPercentScale = 10000;
+}
+
+LatencyHistogram::LatencyHistogram()
+    : buckets(kBucketCount, 0), total(0), minValue(std::numeric_limits<uint64_t>::max()), maxValue(0), sum(0) {
+}
+
+void LatencyHistogram::record(const uint64_t valueNs) {
+    ++buckets[bucketIndex(valueNs)];
+    ++total;
+    sum += static_cast<long double>(valueNs);
+    if (valueNs < minValue)
+        minValue = valueNs;
+    if (valueNs > maxValue)
+        maxValue = valueNs;
+}
+
+uint64_t LatencyHistogram::valueAtPercentile(const double percentile) const {
+    // NaN przeszedłby przez clamp i dał niezdefiniowany wynik llround
+    if (std::isnan(percentile))
+        throw std::invalid_argument("LatencyHistogram::valueAtPercentile: percentyl NaN");
+
+    if (total == 0)
+        return 0;
+
+    // Ranga próbki (1..total) odpowiadająca percentylowi, liczona w arytmetyce całkowitej:
+    // percentyl w jednostkach 10^-4 %, aby np. 99.9 / 100 nie dawało 0.999000...1 i rangi o jeden za dużej.
+    const double clamped = std::clamp(percentile, 0.0, 100.0);
+    const auto scaled = static_cast<__uint128_t>(std::llround(clamped * kPercentScale));
+    constexpr __uint128_t kFullScale = static_cast<__uint128_t>(100) * kPercentScale;
+    auto rank = static_cast<uint64_t>((scaled * total + kFullScale - 1) / kFullScale);
+    if (rank == 0)
+        rank = 1;
+
+    uint64_t seen = 0;
+    for (std::size_t i = 0; i < buckets.size(); ++i) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            const uint64_t upper = bucketUpperBound(i);
+            return upper < maxValue ? upper : maxValue;
+        }
+    }
+    return maxValue;
+}
+
+uint64_t LatencyHistogram::count() const {
+    return total;
+}
+
+uint64_t LatencyHistogram::min() const {
+    return total == 0 ? 0 : minValue;
+}
+
+uint64_t LatencyHistogram::max() const {
+    return maxValue;
+}
+
+double LatencyHistogram::mean() const {
+    return total == 0 ? 0.0 : static_cast<double>(sum / static_cast<long double>(total));
+}
+
+std::size_t LatencyHistogram::bucketIndex(const uint64_t value) {
+    // Małe wartości (< 2^kSubBits) mają kubełki o szerokości 1
+    if (value < kSubCount)
+        return static_cast<std::size_t>(value);
+
+    // Większe: grupa = pozycja najstarszego bitu, podkubełek = kolejne kSubBits bitów
+    const int msb = 63 - __builtin_clzll(value);
+    const int group = msb - kSubBits + 1;
+    const uint64_t sub = (value >> (msb - kSubBits)) & (kSubCount - 1);
+    return static_cast<std::size_t>(group) * kSubCount + static_cast<std::size_t>(sub);
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(const std::size_t index) {
+    if (index < kSubCount)
+        return index;
+
+    const int group = static_cast<int>(index / kSubCount);
+    const uint64_t sub = index % kSubCount;
+    const int msb = group + kSubBits - 1;
+    const int width = msb - kSubBits;
+    const uint64_t lower = (1ULL << msb) | (sub << width);
+    return lower + ((1ULL << width) - 1);
+}
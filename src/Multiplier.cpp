@@ -1,7 +1,7 @@
 #include "Multiplier.h"
 #include <cstdint>
 
-FloatData Multiplier::multiply(const FloatData &a, const FloatData &b) const
+namespace
 {
     // Stałe IEEE 754 dla binary64 (double)
     // bias = 1023, maksymalny wykładnik w polu expBits (11 bitów) to 2047 (0x7FF)
@@ -14,25 +14,143 @@ FloatData Multiplier::multiply(const FloatData &a, const FloatData &b) const
     constexpr uint64_t kFracMask = (1ULL << 52) - 1ULL; // 52 bity jedynek
     constexpr uint64_t kHiddenBit = 1ULL << 52;         // bit 52 (licząc od 0) - "1." dla normalnych
 
+    // Wykładnik najmłodszego bitu liczb subnormalnych: 1 - bias - 52 = -1074
+    constexpr int kMinLsbExp = 1 - kBias - 52;
+
     // Funkcja pomocnicza: składa surowe bity double z:
     // sign (1 bit), expBits (11 bitów, już z biasem), frac (52 bity).
-    auto packBits = [](uint64_t sign, uint64_t expBits, uint64_t frac) -> uint64_t
+    uint64_t packBits(uint64_t sign, uint64_t expBits, uint64_t frac)
     {
-        return (sign << 63) | (expBits << 52) | (frac & ((1ULL << 52) - 1ULL));
-    };
+        return (sign << 63) | (expBits << 52) | (frac & kFracMask);
+    }
+
+    FloatData makeZero(bool sign)
+    {
+        FloatData result{};
+        result.sign = sign;
+        result.type = FloatData::Type::Zero;
+        result.exponent = 0;
+        result.mantissa = 0;
+        result.rawBits = packBits(sign ? 1ULL : 0ULL, 0, 0);
+        return result;
+    }
+
+    FloatData makeInf(bool sign)
+    {
+        FloatData result{};
+        result.sign = sign;
+        result.type = FloatData::Type::Inf;
+        result.exponent = 0;
+        result.mantissa = 0;
+        result.rawBits = packBits(sign ? 1ULL : 0ULL, 0x7FFULL, 0);
+        return result;
+    }
+
+    FloatData makeNaN(bool sign)
+    {
+        FloatData result{};
+        result.sign = sign;
+        result.type = FloatData::Type::NaN;
+        result.exponent = 0; // w tej strukturze exponent trzymamy "do wyświetlania", tu bez znaczenia
+        result.mantissa = 1; // payload (żeby nie było to przypadkiem Inf)
+        result.rawBits = packBits(sign ? 1ULL : 0ULL, 0x7FFULL, result.mantissa);
+        return result;
+    }
+
+    // Pozycja najstarszego ustawionego bitu (sig != 0)
+    int highestBit(__uint128_t sig)
+    {
+        const auto hi = static_cast<uint64_t>(sig >> 64);
+        if (hi != 0)
+            return 127 - __builtin_clzll(hi);
+        return 63 - __builtin_clzll(static_cast<uint64_t>(sig));
+    }
+}
 
-    // Przygotowanie wyniku
+FloatData Multiplier::multiply(const FloatData &a, const FloatData &b) const
+{
     FloatData result{};
+    if (multiplySpecial(a, b, result))
+        return result;
+
+    __uint128_t prod = 0;
+    int lsbExp = 0;
+    exactProduct(a, b, prod, lsbExp);
 
     // Znak wyniku w IEEE754: XOR znaków
-    result.sign = a.sign ^ b.sign;
+    return roundAndPack(a.sign ^ b.sign, prod, lsbExp);
+}
+
+TwoProductData Multiplier::twoProduct(const FloatData &a, const FloatData &b) const
+{
+    TwoProductData result{};
+
+    // Przypadki specjalne: iloczyn zerowy jest dokładny (błąd +0),
+    // a dla Inf/NaN reszta nie ma sensu (tak jak inf - inf) -> NaN.
+    if (multiplySpecial(a, b, result.product))
+    {
+        result.error = (result.product.type == FloatData::Type::Zero) ? makeZero(false) : makeNaN(false);
+        return result;
+    }
+
+    __uint128_t prod = 0;
+    int lsbExp = 0;
+    exactProduct(a, b, prod, lsbExp);
+
+    const bool sign = a.sign ^ b.sign;
+    result.product = roundAndPack(sign, prod, lsbExp);
+
+    if (result.product.type == FloatData::Type::Inf)
+    {
+        result.error = makeNaN(false);
+        return result;
+    }
+
+    // Odtwarzamy zaokrągloną znaczącą w tej samej skali co prod.
+    // Najmłodszy bit wyniku nigdy nie leży poniżej lsbExp (zaokrąglenie tylko obcina bity),
+    // a wartość zaokrąglona jest co najwyżej ~2x większa od prod, więc mieści się w 128 bitach.
+    __uint128_t rounded = 0;
+    if (result.product.type != FloatData::Type::Zero)
+    {
+        uint64_t sigR = result.product.mantissa;
+        int lsbR = kMinLsbExp;
+        if (result.product.type == FloatData::Type::Normal)
+        {
+            sigR |= kHiddenBit;
+            lsbR = result.product.exponent - 52;
+        }
+        rounded = static_cast<__uint128_t>(sigR) << (lsbR - lsbExp);
+    }
+
+    // Reszta = prod - rounded (w jednostkach 2^lsbExp). Jej moduł nie przekracza pół ULP wyniku,
+    // więc mieści się w 53 bitach i (poza niedomiarem) jest dokładnie reprezentowalna.
+    if (prod == rounded)
+        result.error = makeZero(false);
+    else if (prod > rounded)
+        result.error = roundAndPack(sign, prod - rounded, lsbExp);
+    else
+        result.error = roundAndPack(!sign, rounded - prod, lsbExp);
+
+    return result;
+}
+
+bool Multiplier::multiplySpecial(const FloatData &a, const FloatData &b, FloatData &result)
+{
+    // Znak wyniku w IEEE754: XOR znaków
+    const bool sign = a.sign ^ b.sign;
 
     // Obsługa przypadków specjalnych
     // Jeśli którykolwiek argument jest NaN -> wynik NaN (zwykle propagacja NaN)
     if (a.type == FloatData::Type::NaN)
-        return a;
+    {
+        result = a;
+        return true;
+    }
     if (b.type == FloatData::Type::NaN)
-        return b;
+    {
+        result = b;
+        return true;
+    }
 
     // Flagi ułatwiające logikę
     const bool aInf = (a.type == FloatData::Type::Inf);
@@ -43,35 +161,31 @@ FloatData Multiplier::multiply(const FloatData &a, const FloatData &b) const
     // Inf * 0 => NaN (nieoznaczoność)
     if ((aInf && bZero) || (bInf && aZero))
     {
-        result.type = FloatData::Type::NaN;
-        result.exponent = 0; // w tej strukturze exponent trzymamy "do wyświetlania", tu bez znaczenia
-        result.mantissa = 1; // payload (żeby nie było to przypadkiem Inf)
-        result.rawBits = packBits(result.sign ? 1ULL : 0ULL, 0x7FFULL, result.mantissa);
-        return result;
+        result = makeNaN(sign);
+        return true;
     }
 
     // Inf * (cokolwiek niezerowego skończonego) => Inf
     if (aInf || bInf)
     {
-        result.type = FloatData::Type::Inf;
-        result.exponent = 0;
-        result.mantissa = 0;
-        result.rawBits = packBits(result.sign ? 1ULL : 0ULL, 0x7FFULL, 0);
-        return result;
+        result = makeInf(sign);
+        return true;
     }
 
     // 0 * x => 0 (z zachowaniem znaku: XOR znaków daje +0 lub -0)
     if (aZero || bZero)
     {
-        result.type = FloatData::Type::Zero;
-        result.exponent = 0;
-        result.mantissa = 0;
-        result.rawBits = packBits(result.sign ? 1ULL : 0ULL, 0, 0);
-        return result;
+        result = makeZero(sign);
+        return true;
     }
 
+    return false;
+}
+
+void Multiplier::exactProduct(const FloatData &a, const FloatData &b, __uint128_t &prod, int &lsbExp)
+{
     //  Rozpakowanie do postaci roboczej (significand + exponent)
-    auto unpackSigExp = [&](const FloatData &x, uint64_t &sig /*53*/, int &e /*unbiased*/)
+    auto unpackSigExp = [](const FloatData &x, uint64_t &sig /*53*/, int &e /*unbiased*/)
     {
         if (x.type == FloatData::Type::Subnormal)
         {
@@ -111,117 +225,94 @@ FloatData Multiplier::multiply(const FloatData &a, const FloatData &b) const
 
     // Mnożenie znaczących i dodanie wykładników
     // Używamy __uint128_t, żeby to pomieścić bez utraty informacji.
-    __uint128_t prod = static_cast<__uint128_t>(sigA) * static_cast<__uint128_t>(sigB);
-
-    // Wykładniki się dodają (nadal unbiased)
-    int exp = expA + expB; // nadal unbiased
+    prod = static_cast<__uint128_t>(sigA) * static_cast<__uint128_t>(sigB);
 
-    // Normalizacja iloczynu
-    // Sprawdzamy bit 105:
-    const __uint128_t bit105 = (static_cast<__uint128_t>(1) << 105);
+    // Każda znacząca ma najmłodszy bit o wadze 2^(exp - 52),
+    // więc najmłodszy bit iloczynu (106 bitów) ma wagę 2^(expA + expB - 104).
+    lsbExp = expA + expB - 104;
+}
 
-    // Jeśli bit105 = 1, to wynik jest "za duży" (>=2),
-    // więc przesuwamy mocniej (o 53) i zwiększamy wykładnik o 1.
-    // Jeśli bit105 = 0, przesuwamy o 52, aby zostawić 53-bitową znaczącą.
-    int shift = (prod & bit105) ? 53 : 52;
-    if (shift == 53)
-        exp += 1;
+FloatData Multiplier::roundAndPack(const bool sign, const __uint128_t sig, const int lsbExp)
+{
+    if (sig == 0)
+        return makeZero(sign);
 
-    // Wyciągamy "górne" 53 bity jako nową znaczącą (zawiera hidden bit)
-    uint64_t sig = static_cast<uint64_t>(prod >> shift); // top 53 bity
+    // Normalizacja: wykładnik (unbiased) najstarszego bitu wartości
+    const int msb = highestBit(sig);
+    const int exp = msb + lsbExp;
 
-    // Zaokrąglanie (round to nearest, ties to even)
-    __uint128_t remMask = (static_cast<__uint128_t>(1) << shift) - 1;
-    __uint128_t rem = prod & remMask;
+    // Docelowy najmłodszy bit wyniku: 53 bity znaczącej dla Normal,
+    // a w zakresie subnormalnym nie schodzimy poniżej 2^-1074.
+    // Dzięki temu zaokrąglamy tylko raz (bez podwójnego zaokrąglenia przy niedomiarze).
+    int targetLsb = (exp - 52 > kMinLsbExp) ? exp - 52 : kMinLsbExp;
+    const int shift = targetLsb - lsbExp;
 
-    bool guard = (rem >> (shift - 1)) & 1;
-    __uint128_t lowMask = (static_cast<__uint128_t>(1) << (shift - 1)) - 1;
-    bool sticky = (rem & lowMask) != 0;
+    // Wartość mniejsza niż pół najmniejszej subnormalnej -> 0
+    if (shift > msb + 1)
+        return makeZero(sign);
 
-    // Decyzja o zaokrągleniu w górę
-    if (guard && (sticky || (sig & 1ULL)))
+    uint64_t kept = 0;
+    if (shift <= 0)
     {
-        sig += 1ULL;
-        // Możliwa sytuacja: po dodaniu 1 dostajemy przeniesienie,
-        // np. 1.111... + 1 -> 10.000...
-        // Wtedy znów normalizujemy: przesuwamy i zwiększamy wykładnik.
-        if (sig == (1ULL << 53))
+        // Wartość dokładnie reprezentowalna, tylko dosuwamy w lewo
+        kept = static_cast<uint64_t>(sig << -shift);
+    }
+    else
+    {
+        // Zaokrąglanie (round to nearest, ties to even)
+        kept = (shift >= 128) ? 0ULL : static_cast<uint64_t>(sig >> shift);
+        const bool guard = (sig >> (shift - 1)) & 1;
+        const __uint128_t lowMask = (static_cast<__uint128_t>(1) << (shift - 1)) - 1;
+        const bool sticky = (sig & lowMask) != 0;
+
+        // Decyzja o zaokrągleniu w górę
+        if (guard && (sticky || (kept & 1ULL)))
         {
-            sig >>= 1;
-            exp += 1;
+            kept += 1ULL;
+            // Możliwa sytuacja: po dodaniu 1 dostajemy przeniesienie,
+            // np. 1.111... + 1 -> 10.000...
+            // Wtedy znów normalizujemy: przesuwamy i zwiększamy wykładnik.
+            if (kept == (1ULL << 53))
+            {
+                kept >>= 1;
+                targetLsb += 1;
+            }
         }
     }
 
-    // Spakowanie wyniku do formatu IEEE754 (rawBits)
-    // Pole expBits w rawBits ma bias, więc dodajemy bias dopiero tutaj.
-    int expBits = exp + kBias;
+    FloatData result{};
+    result.sign = sign;
 
-    // Overflow: wykładnik za duży -> Inf
-    if (expBits >= kExpMax)
+    if (kept == 0)
+        return makeZero(sign);
+
+    // Brak ukrytego bitu -> Subnormal (targetLsb = -1074, expBits = 0)
+    // Subnormalna zaokrąglona w górę do 2^52 trafia do gałęzi Normal (najmniejsza normalna).
+    if ((kept & kHiddenBit) == 0)
     {
-        result.type = FloatData::Type::Inf;
-        result.exponent = 0;
-        result.mantissa = 0;
-        result.rawBits = packBits(result.sign ? 1ULL : 0ULL, 0x7FFULL, 0);
+        result.type = FloatData::Type::Subnormal;
+        result.exponent = static_cast<int16_t>(1 - kBias); // -1022
+        result.mantissa = kept & kFracMask;
+        result.rawBits = packBits(sign ? 1ULL : 0ULL, 0, result.mantissa);
         return result;
     }
 
-    // Underflow: wykładnik za mały -> Subnormal lub Zero
-    if (expBits <= 0)
-    {
-        // Chcemy zejść do expBits = 0 (subnormal). To oznacza przesunięcie znaczącej w prawo.
-        int k = 1 - expBits; // o ile bitów przesunąć w prawo
-
-        // Jeśli trzeba przesunąć "za dużo", to wynik jest 0
-        if (k >= 64)
-        {
-            result.type = FloatData::Type::Zero;
-            result.exponent = 0;
-            result.mantissa = 0;
-            result.rawBits = packBits(result.sign ? 1ULL : 0ULL, 0, 0);
-            return result;
-        }
-
-        uint64_t sub = sig;
-
-        // Rounding podczas zejścia do subnormal:
-        // analogicznie używamy guard/sticky dla przesunięcia o k.
-        uint64_t shiftedOutMask = (k >= 64) ? ~0ULL : ((1ULL << k) - 1ULL);
-        uint64_t shiftedOut = sub & shiftedOutMask;
-        bool g = (k > 0) ? ((sub >> (k - 1)) & 1ULL) : false;
-        bool st = (k > 1) ? ((shiftedOut & ((1ULL << (k - 1)) - 1ULL)) != 0) : false;
-
-        sub >>= k;
-        if (g && (st || (sub & 1ULL)))
-            sub += 1ULL;
-
-        // Mantysa w subnormal to po prostu 52 bity (bez hidden bit)
-        result.mantissa = sub & kFracMask;
+    // Spakowanie wyniku do formatu IEEE754 (rawBits)
+    // Pole expBits w rawBits ma bias, więc dodajemy bias dopiero tutaj.
+    const int resultExp = targetLsb + 52;
+    const int expBits = resultExp + kBias;
 
-        // Jeśli po przesunięciu i zaokrągleniu wyszło 0 -> Zero
-        if (result.mantissa == 0)
-        {
-            // Subnormal: expBits = 0 w rawBits, a exponent do wyświetlania ustawiamy na -1022
-            result.type = FloatData::Type::Zero;
-            result.exponent = 0;
-            result.rawBits = packBits(result.sign ? 1ULL : 0ULL, 0, 0);
-        }
-        else
-        {
-            result.type = FloatData::Type::Subnormal;
-            result.exponent = static_cast<int16_t>(1 - kBias); // -1022
-            result.rawBits = packBits(result.sign ? 1ULL : 0ULL, 0, result.mantissa);
-        }
-        return result;
-    }
+    // Overflow: wykładnik za duży -> Inf
+    if (expBits >= kExpMax)
+        return makeInf(sign);
 
     // Normalny wynik:
     // - typ Normal
     // - exponent w strukturze trzymamy unbiased (do wyświetlania)
     // - w rawBits zapisujemy expBits (biased)
     result.type = FloatData::Type::Normal;
-    result.exponent = static_cast<int16_t>(exp); // unbiased do logów/wyświetlania
-    result.mantissa = sig & kFracMask;           // odcinamy hidden bit (zostaje 52-bitowa część ułamkowa)
-    result.rawBits = packBits(result.sign ? 1ULL : 0ULL, static_cast<uint64_t>(expBits), result.mantissa);
+    result.exponent = static_cast<int16_t>(resultExp); // unbiased do logów/wyświetlania
+    result.mantissa = kept & kFracMask;                // odcinamy hidden bit (zostaje 52-bitowa część ułamkowa)
+    result.rawBits = packBits(sign ? 1ULL : 0ULL, static_cast<uint64_t>(expBits), result.mantissa);
     return result;
-}
\ No newline at end of file
+}
@@ -0,0 +1,41 @@
+#include "RecordingMultiplier.h"
+#include <iostream>
+#include <stdexcept>
+
+RecordingMultiplier::RecordingMultiplier(std::unique_ptr<IMultiplier> inner, const std::string &logPath,
+                                         const WorkloadLogWriter::FlushPolicy policy)
+    : inner(std::move(inner)), start(std::chrono::steady_clock::now()), writer(logPath, policy) {
+}
+
+RecordingMultiplier::~RecordingMultiplier() {
+    // Destruktor nie może rzucać wyjątku, więc błąd zapisu tylko zgłaszamy
+    try {
+        writer.flush();
+    } catch (const std::runtime_error &e) {
+        std::cout << "Blad: " << e.what() << "\n";
+    }
+}
+
+FloatData RecordingMultiplier::multiply(const FloatData &a, const FloatData &b) const {
+    record(a, b, WorkloadRecord::Operation::Multiply);
+    return inner->multiply(a, b);
+}
+
+TwoProductData RecordingMultiplier::twoProduct(const FloatData &a, const FloatData &b) const {
+    record(a, b, WorkloadRecord::Operation::TwoProduct);
+    return inner->twoProduct(a, b);
+}
+
+void RecordingMultiplier::record(const FloatData &a, const FloatData &b,
+                                 const WorkloadRecord::Operation operation) const {
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    WorkloadRecord entry{};
+    entry.timestampNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    entry.aBits = a.rawBits;
+    entry.bBits = b.rawBits;
+    entry.operation = operation;
+
+    std::lock_guard lock(writerMutex);
+    writer.append(entry);
+}
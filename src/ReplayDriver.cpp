@@ -0,0 +1,101 @@
+#include "ReplayDriver.h"
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <thread>
+
+namespace {
+    const char *className(const OperandClass operandClass) {
+        switch (operandClass) {
+            case OperandClass::Normal:
+                return "Normal";
+            case OperandClass::Subnormal:
+                return "Subnormal";
+            case OperandClass::Special:
+                return "Specjalne";
+            default:
+                return "?";
+        }
+    }
+
+    void printHistogram(std::ostream &os, const char *label, const LatencyHistogram &histogram) {
+        os << "  " << std::left << std::setw(10) << label << std::right
+                << " n=" << std::setw(10) << histogram.count();
+        if (histogram.count() == 0) {
+            os << "\n";
+            return;
+        }
+        os << " min=" << histogram.min()
+                << " p50=" << histogram.valueAtPercentile(50.0)
+                << " p99=" << histogram.valueAtPercentile(99.0)
+                << " p99.9=" << histogram.valueAtPercentile(99.9)
+                << " max=" << histogram.max()
+                << " srednia=" << std::fixed << std::setprecision(1) << histogram.mean() << std::defaultfloat
+                << "\n";
+    }
+}
+
+OperandClass classifyOperands(const FloatData &a, const FloatData &b) {
+    auto isSpecial = [](const FloatData &x) {
+        return x.type == FloatData::Type::Zero || x.type == FloatData::Type::Inf || x.type == FloatData::Type::NaN;
+    };
+
+    if (isSpecial(a) || isSpecial(b))
+        return OperandClass::Special;
+    if (a.type == FloatData::Type::Subnormal || b.type == FloatData::Type::Subnormal)
+        return OperandClass::Subnormal;
+    return OperandClass::Normal;
+}
+
+void ReplayReport::print(std::ostream &os) const {
+    os << "\n--- RAPORT ODTWORZENIA (opoznienia w ns) ---\n";
+    printHistogram(os, "Wszystkie", overall);
+    for (std::size_t i = 0; i < byClass.size(); ++i)
+        printHistogram(os, className(static_cast<OperandClass>(i)), byClass[i]);
+    os << "  Czas calkowity: " << wallTimeNs << " ns\n";
+    os << "  Suma kontrolna wynikow: 0x" << std::hex << checksum << std::dec << "\n";
+}
+
+ReplayDriver::ReplayDriver(const IDecomposer &decomposer, const IMultiplier &multiplier)
+    : decomposer(decomposer), multiplier(multiplier) {
+}
+
+ReplayReport ReplayDriver::replay(const std::vector<WorkloadRecord> &records, const Pace pace) const {
+    using Clock = std::chrono::steady_clock;
+
+    ReplayReport report;
+    const auto start = Clock::now();
+
+    for (const WorkloadRecord &record : records) {
+        // Argumenty odtwarzamy z surowych bitów, tak jak przekazał je Decomposer
+        double a, b;
+        std::memcpy(&a, &record.aBits, sizeof(double));
+        std::memcpy(&b, &record.bBits, sizeof(double));
+        const FloatData dataA = decomposer.decompose(a);
+        const FloatData dataB = decomposer.decompose(b);
+
+        if (pace == Pace::OriginalRate)
+            std::this_thread::sleep_until(start + std::chrono::nanoseconds(record.timestampNs));
+
+        // Mierzymy wyłącznie samo wywołanie mnożenia
+        const auto before = Clock::now();
+        uint64_t resultBits;
+        if (record.operation == WorkloadRecord::Operation::TwoProduct) {
+            const TwoProductData result = multiplier.twoProduct(dataA, dataB);
+            resultBits = result.product.rawBits ^ result.error.rawBits;
+        } else {
+            resultBits = multiplier.multiply(dataA, dataB).rawBits;
+        }
+        const auto after = Clock::now();
+        report.checksum = report.checksum * 31 + resultBits;
+
+        const auto latency = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+        report.overall.record(latency);
+        report.byClass[static_cast<std::size_t>(classifyOperands(dataA, dataB))].record(latency);
+    }
+
+    report.wallTimeNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    return report;
+}
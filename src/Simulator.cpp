@@ -20,12 +20,14 @@ void Simulator::run(const double a, const double b) const {
 
     // 2. Mnożenie
     std::cout << "[Krok 2] Mnozenie mantys i korekcja wykladnikow...\n";
-    const FloatData resultData = multiplier->multiply(dataA, dataB);
+    const TwoProductData productData = multiplier->twoProduct(dataA, dataB);
+    const FloatData &resultData = productData.product;
     std::cout << "  Wynik (dane): " << resultData.toString() << "\n";
 
     // 3. Złożenie wyniku
     const double result = decomposer->compose(resultData);
     std::cout << "[Krok 3] Wynik koncowy: " << result << "\n";
+    std::cout << "  Blad zaokraglenia (A * B - wynik): " << decomposer->compose(productData.error) << "\n";
 
     // 4. Weryfikacja
     std::cout << "[Info] Oczekiwany wynik koncowy: " << (a * b) << "\n";
@@ -0,0 +1,89 @@
+#include "WorkloadLog.h"
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+namespace {
+    constexpr std::array<char, 4> kMagic = {'B', '6', '4', 'W'};
+    constexpr uint32_t kVersion = 1;
+    constexpr std::size_t kRecordSize = 8 + 8 + 8 + 1;
+
+    // Zapis/odczyt little-endian niezależnie od platformy
+    void putLE(char *dst, uint64_t value, const std::size_t bytes) {
+        for (std::size_t i = 0; i < bytes; ++i) {
+            dst[i] = static_cast<char>(value & 0xFFULL);
+            value >>= 8;
+        }
+    }
+
+    uint64_t getLE(const char *src, const std::size_t bytes) {
+        uint64_t value = 0;
+        for (std::size_t i = bytes; i-- > 0;)
+            value = (value << 8) | static_cast<unsigned char>(src[i]);
+        return value;
+    }
+}
+
+WorkloadLogWriter::WorkloadLogWriter(const std::string &path, const FlushPolicy policy)
+    : out(path, std::ios::binary | std::ios::trunc), policy(policy) {
+    if (!out)
+        throw std::runtime_error("Nie mozna otworzyc pliku do zapisu: " + path);
+
+    std::array<char, 8> header{};
+    std::copy(kMagic.begin(), kMagic.end(), header.begin());
+    putLE(header.data() + 4, kVersion, 4);
+    out.write(header.data(), header.size());
+    out.flush();
+    if (!out)
+        throw std::runtime_error("Nie mozna zapisac naglowka dziennika: " + path);
+}
+
+void WorkloadLogWriter::append(const WorkloadRecord &record) {
+    std::array<char, kRecordSize> buffer{};
+    putLE(buffer.data(), record.timestampNs, 8);
+    putLE(buffer.data() + 8, record.aBits, 8);
+    putLE(buffer.data() + 16, record.bBits, 8);
+    buffer[24] = static_cast<char>(record.operation);
+    out.write(buffer.data(), buffer.size());
+    if (policy == FlushPolicy::EveryRecord)
+        out.flush();
+    if (!out)
+        throw std::runtime_error("Nie mozna zapisac rekordu do dziennika");
+}
+
+void WorkloadLogWriter::flush() {
+    out.flush();
+    if (!out)
+        throw std::runtime_error("Nie mozna zapisac dziennika na dysk");
+}
+
+std::vector<WorkloadRecord> readWorkloadLog(const std::string &path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        throw std::runtime_error("Nie mozna otworzyc pliku: " + path);
+
+    std::array<char, 8> header{};
+    if (!in.read(header.data(), header.size())
+        || !std::equal(kMagic.begin(), kMagic.end(), header.begin())
+        || getLE(header.data() + 4, 4) != kVersion)
+        throw std::runtime_error("Niepoprawny naglowek dziennika: " + path);
+
+    std::vector<WorkloadRecord> records;
+    std::array<char, kRecordSize> buffer{};
+    while (in.read(buffer.data(), buffer.size())) {
+        WorkloadRecord record{};
+        record.timestampNs = getLE(buffer.data(), 8);
+        record.aBits = getLE(buffer.data() + 8, 8);
+        record.bBits = getLE(buffer.data() + 16, 8);
+        record.operation = static_cast<WorkloadRecord::Operation>(buffer[24]);
+        if (record.operation != WorkloadRecord::Operation::Multiply
+            && record.operation != WorkloadRecord::Operation::TwoProduct)
+            throw std::runtime_error("Nieznana operacja w dzienniku: " + path);
+        records.push_back(record);
+    }
+
+    if (in.gcount() != 0)
+        throw std::runtime_error("Uciety rekord na koncu dziennika: " + path);
+
+    return records;
+}
@@ -0,0 +1,67 @@
+#include "LatencyHistogram.h"
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    int failures = 0;
+
+    void expectEqual(const uint64_t actual, const uint64_t expected, const char *what) {
+        if (actual != expected) {
+            std::cout << "BLAD: " << what << ": " << actual << " (oczekiwano " << expected << ")\n";
+            ++failures;
+        }
+    }
+}
+
+int main() {
+    // 999 próbek po 100 ns i jedna odstająca: p99.9 to wciąż 999. próbka (100 ns),
+    // mimo że 99.9 / 100 w binary64 jest odrobinę większe niż 0.999.
+    LatencyHistogram histogram;
+    for (int i = 0; i < 999; ++i)
+        histogram.record(100);
+    histogram.record(1000000);
+
+    expectEqual(histogram.valueAtPercentile(50.0), 100, "p50");
+    expectEqual(histogram.valueAtPercentile(99.0), 100, "p99");
+    expectEqual(histogram.valueAtPercentile(99.9), 100, "p99.9");
+    expectEqual(histogram.valueAtPercentile(100.0), 1000000, "p100");
+
+    // Ta sama granica dla 10000 próbek: ranga 9990 -> 100, ranga 9991 -> odstające
+    LatencyHistogram larger;
+    for (int i = 0; i < 9990; ++i)
+        larger.record(100);
+    for (int i = 0; i < 10; ++i)
+        larger.record(1000000);
+
+    expectEqual(larger.valueAtPercentile(99.9), 100, "p99.9 (n=10000)");
+    expectEqual(larger.valueAtPercentile(99.91), 1000000, "p99.91 (n=10000)");
+
+    // Percentyl NaN jest odrzucany, a wartości spoza [0, 100] przycinane
+    bool threw = false;
+    try {
+        static_cast<void>(histogram.valueAtPercentile(std::numeric_limits<double>::quiet_NaN()));
+    } catch (const std::invalid_argument &) {
+        threw = true;
+    }
+    expectEqual(threw, true, "NaN -> std::invalid_argument");
+    expectEqual(histogram.valueAtPercentile(-5.0), 100, "p(-5) -> p0");
+    expectEqual(histogram.valueAtPercentile(150.0), 1000000, "p150 -> p100");
+
+    // Granice kubełków: do 127 szerokość 1, od 256 szerokość 2, ostatni kubełek kończy się na UINT64_MAX
+    constexpr uint64_t kMax = std::numeric_limits<uint64_t>::max();
+    expectEqual(LatencyHistogram::bucketIndex(127), 127, "bucketIndex(127)");
+    expectEqual(LatencyHistogram::bucketIndex(128), 128, "bucketIndex(128)");
+    expectEqual(LatencyHistogram::bucketIndex(255), 255, "bucketIndex(255)");
+    expectEqual(LatencyHistogram::bucketIndex(256), 256, "bucketIndex(256)");
+    expectEqual(LatencyHistogram::bucketIndex(257), 256, "bucketIndex(257)");
+    expectEqual(LatencyHistogram::bucketIndex(kMax), 58 * 128 - 1, "bucketIndex(UINT64_MAX)");
+    expectEqual(LatencyHistogram::bucketUpperBound(127), 127, "bucketUpperBound(127)");
+    expectEqual(LatencyHistogram::bucketUpperBound(128), 128, "bucketUpperBound(128)");
+    expectEqual(LatencyHistogram::bucketUpperBound(255), 255, "bucketUpperBound(255)");
+    expectEqual(LatencyHistogram::bucketUpperBound(256), 257, "bucketUpperBound(256)");
+    expectEqual(LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(kMax)), kMax,
+                "bucketUpperBound(ostatni)");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,179 @@
+#include "Decomposer.h"
+#include "DoubleDouble.h"
+#include "Multiplier.h"
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    int failures = 0;
+
+    void expectEqual(const uint64_t actual, const uint64_t expected, const char *what) {
+        if (actual != expected) {
+            std::cout << "BLAD: " << what << ": 0x" << std::hex << actual
+                    << " (oczekiwano 0x" << expected << ")" << std::dec << "\n";
+            ++failures;
+        }
+    }
+
+    void expectTrue(const bool condition, const char *what) {
+        if (!condition) {
+            std::cout << "BLAD: " << what << "\n";
+            ++failures;
+        }
+    }
+
+    uint64_t toBits(const double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(double));
+        return bits;
+    }
+
+    double fromBits(const uint64_t bits) {
+        double value;
+        std::memcpy(&value, &bits, sizeof(double));
+        return value;
+    }
+
+    const Decomposer decomposer;
+    const Multiplier multiplier;
+
+    double multiply(const double a, const double b) {
+        return decomposer.compose(multiplier.multiply(decomposer.decompose(a), decomposer.decompose(b)));
+    }
+
+    // Losowa liczba o wykładniku (biased) z zakresu [expLow, expHigh]
+    double randomWithExponent(std::mt19937_64 &rng, const uint64_t expLow, const uint64_t expHigh) {
+        const uint64_t expBits = expLow + rng() % (expHigh - expLow + 1);
+        const uint64_t bits = (rng() & 0x800FFFFFFFFFFFFFULL) | (expBits << 52);
+        return fromBits(bits);
+    }
+
+    void testUnderflowMatchesHardware() {
+        // Zaokrąglenie w górę do najmniejszej liczby normalnej: (1 - 2^-53) * 2^-1022
+        // leży dokładnie w połowie między największą subnormalną a 2^-1022 (ties to even -> 2^-1022).
+        const double justBelowOne = std::nextafter(1.0, 0.0);
+        const double minNormal = std::numeric_limits<double>::min();
+        expectEqual(toBits(multiply(justBelowOne, minNormal)), toBits(minNormal), "zaokraglenie do 2^-1022");
+        expectEqual(toBits(justBelowOne * minNormal), toBits(minNormal), "sprzet: zaokraglenie do 2^-1022");
+
+        // Najmniejsza subnormalna i połowa (ties to even -> 0)
+        const double minSubnormal = std::numeric_limits<double>::denorm_min();
+        expectEqual(toBits(multiply(minSubnormal, 1.0)), toBits(minSubnormal), "denorm_min * 1");
+        expectEqual(toBits(multiply(minSubnormal, 0.5)), toBits(0.0), "denorm_min * 0.5");
+        expectEqual(toBits(multiply(minSubnormal, -0.75)), toBits(-minSubnormal), "denorm_min * -0.75");
+
+        // Losowe pary, których iloczyn trafia w okolice zakresu subnormalnego
+        std::mt19937_64 rng(26);
+        int mismatches = 0;
+        for (int i = 0; i < 200000; ++i) {
+            // Suma wykładników (biased) w okolicy 1023, czyli iloczyn w pobliżu 2^-1022 i niżej
+            const double a = randomWithExponent(rng, 0, 1023);
+            const uint64_t expA = (toBits(a) >> 52) & 0x7FFULL;
+            const uint64_t expB = 1023 - expA;
+            const double b = randomWithExponent(rng, expB > 55 ? expB - 55 : 0, expB + 1);
+            if (toBits(multiply(a, b)) != toBits(a * b))
+                ++mismatches;
+        }
+        expectEqual(mismatches, 0, "iloczyny w zakresie niedomiaru zgodne ze sprzetem");
+    }
+
+    void testTwoProductMatchesFma() {
+        const DoubleDoubleMultiplier dd(decomposer, multiplier);
+
+        std::mt19937_64 rng(27);
+        int mismatches = 0;
+        for (int i = 0; i < 200000; ++i) {
+            // Wykładniki dobrane tak, by błąd nie wpadał w niedomiar, a iloczyn nie przepełniał
+            const double a = randomWithExponent(rng, 600, 1500);
+            const double b = randomWithExponent(rng, 600, 1500);
+            const DoubleDouble p = dd.twoProduct(a, b);
+            if (toBits(p.hi) != toBits(a * b) || toBits(p.lo) != toBits(std::fma(a, b, -(a * b))))
+                ++mismatches;
+        }
+        expectEqual(mismatches, 0, "twoProduct zgodny z fma(a, b, -p)");
+    }
+
+    void testTwoProductSpecialCases() {
+        const DoubleDoubleMultiplier dd(decomposer, multiplier);
+        const double inf = std::numeric_limits<double>::infinity();
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+
+        DoubleDouble p = dd.twoProduct(0.0, 3.0);
+        expectEqual(toBits(p.hi), toBits(0.0), "0 * 3: iloczyn");
+        expectEqual(toBits(p.lo), toBits(0.0), "0 * 3: blad +0");
+
+        p = dd.twoProduct(-0.0, 3.0);
+        expectEqual(toBits(p.hi), toBits(-0.0), "-0 * 3: iloczyn");
+        expectEqual(toBits(p.lo), toBits(0.0), "-0 * 3: blad +0");
+
+        p = dd.twoProduct(inf, 2.0);
+        expectEqual(toBits(p.hi), toBits(inf), "inf * 2: iloczyn");
+        expectTrue(std::isnan(p.lo), "inf * 2: blad NaN");
+
+        p = dd.twoProduct(inf, 0.0);
+        expectTrue(std::isnan(p.hi) && std::isnan(p.lo), "inf * 0: iloczyn i blad NaN");
+
+        p = dd.twoProduct(nan, 1.0);
+        expectTrue(std::isnan(p.hi) && std::isnan(p.lo), "NaN * 1: iloczyn i blad NaN");
+
+        p = dd.twoProduct(0x1p1000, 0x1p1000);
+        expectEqual(toBits(p.hi), toBits(inf), "przepelnienie: iloczyn");
+        expectTrue(std::isnan(p.lo), "przepelnienie: blad NaN");
+    }
+
+    void testDoubleDoubleInfinity() {
+        const DoubleDoubleMultiplier dd(decomposer, multiplier);
+        const double inf = std::numeric_limits<double>::infinity();
+
+        DoubleDouble p = dd.multiply(DoubleDouble{inf, 0.0}, 2.0);
+        expectEqual(toBits(p.hi), toBits(inf), "{inf,0} * 2: hi");
+        expectEqual(toBits(p.lo), toBits(0.0), "{inf,0} * 2: lo");
+
+        p = dd.multiply(DoubleDouble{0x1p1000, 0.0}, DoubleDouble{0x1p1000, 0.0});
+        expectEqual(toBits(p.hi), toBits(inf), "{2^1000,0}^2: hi");
+        expectEqual(toBits(p.lo), toBits(0.0), "{2^1000,0}^2: lo");
+
+        p = dd.multiply(DoubleDouble{1.0, 0.0}, DoubleDouble{-inf, 0.0});
+        expectEqual(toBits(p.hi), toBits(-inf), "{1,0} * {-inf,0}: hi");
+        expectEqual(toBits(p.lo), toBits(0.0), "{1,0} * {-inf,0}: lo");
+    }
+
+    void testBatchSizeMismatch() {
+        const DoubleDoubleMultiplier dd(decomposer, multiplier);
+        const std::vector<double> a(3, 1.0), b(2, 1.0);
+        const std::vector<DoubleDouble> x(3, DoubleDouble{1.0, 0.0}), y(2, DoubleDouble{1.0, 0.0});
+        std::vector<DoubleDouble> out(3);
+
+        auto expectThrows = [](auto &&call, const char *what) {
+            try {
+                call();
+                expectTrue(false, what);
+            } catch (const std::invalid_argument &) {
+            }
+        };
+
+        expectThrows([&] { dd.twoProduct(a, b, out); }, "twoProduct: rozne dlugosci wejsc");
+        expectThrows([&] { dd.multiply(x, y, out); }, "multiply dd*dd: rozne dlugosci wejsc");
+        expectThrows([&] { dd.multiply(x, b, out); }, "multiply dd*double: rozne dlugosci wejsc");
+        expectThrows([&] { dd.twoProduct(a, a, std::span(out).first(2)); }, "twoProduct: za krotkie wyjscie");
+
+        // Zgodne długości: wynik taki jak wersja skalarna
+        dd.multiply(x, a, out);
+        expectEqual(toBits(out[2].hi), toBits(1.0), "multiply dd*double wsadowo");
+    }
+}
+
+int main() {
+    testUnderflowMatchesHardware();
+    testTwoProductMatchesFma();
+    testTwoProductSpecialCases();
+    testDoubleDoubleInfinity();
+    testBatchSizeMismatch();
+
+    return failures == 0 ? 0 : 1;
+}
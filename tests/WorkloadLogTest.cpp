@@ -0,0 +1,131 @@
+#include "ReplayDriver.h"
+#include "WorkloadLog.h"
+#include "Decomposer.h"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    int failures = 0;
+
+    void expectEqual(const uint64_t actual, const uint64_t expected, const char *what) {
+        if (actual != expected) {
+            std::cout << "BLAD: " << what << ": 0x" << std::hex << actual
+                    << " (oczekiwano 0x" << expected << ")" << std::dec << "\n";
+            ++failures;
+        }
+    }
+
+    std::string tempPath(const char *name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    void writeBytes(const std::string &path, const std::vector<unsigned char> &bytes) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    // Nagłówek "B64W" + wersja 1 (little-endian)
+    std::vector<unsigned char> validHeader() {
+        return {'B', '6', '4', 'W', 1, 0, 0, 0};
+    }
+
+    void expectReadFails(const std::string &path, const char *what) {
+        try {
+            static_cast<void>(readWorkloadLog(path));
+            std::cout << "BLAD: " << what << ": brak wyjatku\n";
+            ++failures;
+        } catch (const std::runtime_error &) {
+        }
+    }
+
+    void testRoundTrip() {
+        const std::string path = tempPath("b64w_roundtrip.log");
+        const std::vector<WorkloadRecord> written = {
+            {0, 0x8000000000000000ULL, 0x0000000000000001ULL, WorkloadRecord::Operation::Multiply}, // -0 * denorm_min
+            {42, 0x7FF0000000000123ULL, 0xFFF8000000000000ULL, WorkloadRecord::Operation::TwoProduct}, // NaN z ładunkiem
+            {0xFFFFFFFFFFFFFFFFULL, 0x000FFFFFFFFFFFFFULL, 0x7FF0000000000000ULL, WorkloadRecord::Operation::Multiply},
+            {7, 0x3FF0000000000000ULL, 0x800FFFFFFFFFFFFFULL, WorkloadRecord::Operation::TwoProduct},
+        };
+
+        {
+            WorkloadLogWriter writer(path);
+            for (const WorkloadRecord &record : written)
+                writer.append(record);
+        }
+
+        const std::vector<WorkloadRecord> read = readWorkloadLog(path);
+        expectEqual(read.size(), written.size(), "liczba rekordow");
+        for (std::size_t i = 0; i < read.size() && i < written.size(); ++i) {
+            expectEqual(read[i].timestampNs, written[i].timestampNs, "timestampNs");
+            expectEqual(read[i].aBits, written[i].aBits, "aBits");
+            expectEqual(read[i].bBits, written[i].bBits, "bBits");
+            expectEqual(static_cast<uint64_t>(read[i].operation), static_cast<uint64_t>(written[i].operation),
+                        "operation");
+        }
+        expectEqual(std::filesystem::file_size(path), 8 + written.size() * 25, "rozmiar pliku");
+        std::filesystem::remove(path);
+    }
+
+    void testReaderErrors() {
+        const std::string path = tempPath("b64w_errors.log");
+
+        writeBytes(path, {'B', '6', '4', 'X', 1, 0, 0, 0});
+        expectReadFails(path, "zla sygnatura");
+
+        writeBytes(path, {'B', '6', '4', 'W', 2, 0, 0, 0});
+        expectReadFails(path, "zla wersja");
+
+        writeBytes(path, {'B', '6', '4'});
+        expectReadFails(path, "uciety naglowek");
+
+        // Pełny rekord i ucięty drugi (gcount() != 0)
+        std::vector<unsigned char> bytes = validHeader();
+        bytes.resize(bytes.size() + 25 + 10, 0);
+        writeBytes(path, bytes);
+        expectReadFails(path, "uciety ostatni rekord");
+
+        // Nieznany bajt operacji
+        bytes = validHeader();
+        bytes.resize(bytes.size() + 25, 0);
+        bytes.back() = 7;
+        writeBytes(path, bytes);
+        expectReadFails(path, "nieznana operacja");
+
+        // Sam nagłówek: pusty, poprawny dziennik
+        writeBytes(path, validHeader());
+        expectEqual(readWorkloadLog(path).size(), 0, "pusty dziennik");
+
+        std::filesystem::remove(path);
+        expectReadFails(path, "brak pliku");
+    }
+
+    void testClassifyOperands() {
+        const Decomposer decomposer;
+        const FloatData normal = decomposer.decompose(1.5);
+        const FloatData subnormal = decomposer.decompose(4.9e-324);
+        const FloatData zero = decomposer.decompose(0.0);
+        const FloatData inf = decomposer.decompose(1.0 / 0.0);
+
+        auto expectClass = [](const OperandClass actual, const OperandClass expected, const char *what) {
+            expectEqual(static_cast<uint64_t>(actual), static_cast<uint64_t>(expected), what);
+        };
+
+        expectClass(classifyOperands(normal, normal), OperandClass::Normal, "Normal x Normal");
+        expectClass(classifyOperands(normal, subnormal), OperandClass::Subnormal, "Normal x Subnormal");
+        expectClass(classifyOperands(subnormal, subnormal), OperandClass::Subnormal, "Subnormal x Subnormal");
+        expectClass(classifyOperands(subnormal, zero), OperandClass::Special, "Subnormal x Zero");
+        expectClass(classifyOperands(inf, subnormal), OperandClass::Special, "Inf x Subnormal");
+    }
+}
+
+int main() {
+    testRoundTrip();
+    testReaderErrors();
+    testClassifyOperands();
+
+    return failures == 0 ? 0 : 1;
+}